@@ -12,7 +12,8 @@ import CoreData
 
 class HomeViewController:UIViewController{
     @IBOutlet weak var tableView: UITableView!
-    var memoDataList:[MemoDataModel] = []
+    // Resultsのまま保持し、オブジェクトは表示する時に読み込む
+    var memoDataList:Results<MemoDataModel>?
     let themeColoTypeKey = "themeColoTyperKey"
     override func viewDidLoad() {
         super.viewDidLoad()
@@ -31,9 +32,9 @@ class HomeViewController:UIViewController{
     }
     
     func setMemoData(){
+       guard memoDataList == nil else { return }
        let realm = try! Realm()
-       let result = realm.objects(MemoDataModel.self)
-       memoDataList = Array(result)
+       memoDataList = realm.objects(MemoDataModel.self)
     }
     
     @objc func tapAddButton(){
@@ -99,12 +100,12 @@ class HomeViewController:UIViewController{
 extension HomeViewController:UITableViewDataSource{
     //セルの数
     func tableView(_ tableView: UITableView, numberOfRowsInSection section: Int) -> Int {
-        return memoDataList.count
+        return memoDataList?.count ?? 0
     }
     //セルの中身
     func tableView(_ tableView: UITableView, cellForRowAt indexPath: IndexPath) -> UITableViewCell {
         let cell = UITableViewCell(style: .subtitle, reuseIdentifier: "cell")
-        let memoDataModel:MemoDataModel = memoDataList[indexPath.row]
+        guard let memoDataModel = memoDataList?[indexPath.row] else { return cell }
         cell.textLabel?.text = memoDataModel.text
         cell.detailTextLabel?.text = "\(memoDataModel.recordDate)"
         return cell
@@ -117,17 +118,16 @@ extension HomeViewController:UITableViewDelegate{
         let memoDetailViewController = storyboard.instantiateViewController(identifier: "MemoDetailViewController") as! MemoDetailViewController
         tableView.deselectRow(at: indexPath, animated: true)
         navigationController?.pushViewController(memoDetailViewController, animated: true)
-        var memoData = memoDataList[indexPath.row]
+        guard let memoData = memoDataList?[indexPath.row] else { return }
         memoDetailViewController.configure(memoDetailData: memoData)
     }
     
     func tableView(_ tableView: UITableView, commit editingStyle: UITableViewCell.EditingStyle, forRowAt indexPath: IndexPath) {
-        let target = memoDataList[indexPath.row]
+        guard let target = memoDataList?[indexPath.row] else { return }
         let realm = try! Realm()
         try! realm.write{
             realm.delete(target)
         }
-        memoDataList.remove(at: indexPath.row)
         tableView.deleteRows(at: [indexPath], with: .automatic)
     }
 }
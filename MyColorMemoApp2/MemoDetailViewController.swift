@@ -18,6 +18,9 @@ class MemoDetailViewController:UIViewController{
     }
     // MemoDataModelをインスタンス化しているからmemoData
     var memoData = MemoDataModel()
+    // 入力中のテキストはまとめて保存する(キー入力ごとに書き込みしない)
+    var pendingText:String?
+    let saveDelay:TimeInterval = 0.5
     override func viewDidLoad() {
         super.viewDidLoad()
         displayData()
@@ -25,6 +28,11 @@ class MemoDetailViewController:UIViewController{
         textView.delegate = self
     }
     
+    override func viewWillDisappear(_ animated: Bool) {
+        super.viewWillDisappear(animated)
+        savePendingText()
+    }
+    
     func configure(memoDetailData:MemoDataModel){
         memoData.text = memoDetailData.text
         memoData.recordDate = memoDetailData.recordDate
@@ -38,6 +46,7 @@ class MemoDetailViewController:UIViewController{
     //いつこのメソッドが呼び出されるか
     @objc func tapDoneButton(){
         view.endEditing(true)
+        savePendingText()
     }
     //viewに配置
     func setDoneButton(){
@@ -56,11 +65,26 @@ class MemoDetailViewController:UIViewController{
         }
         print("text:\(memoData.text) recordData:\(memoData.recordDate)")
     }
+    
+    func scheduleSave(with text:String){
+        let isScheduled = pendingText != nil
+        pendingText = text
+        guard !isScheduled else { return }
+        DispatchQueue.main.asyncAfter(deadline: .now() + saveDelay) { [weak self] in
+            self?.savePendingText()
+        }
+    }
+    
+    func savePendingText(){
+        guard let text = pendingText else { return }
+        pendingText = nil
+        saveData(with: text)
+    }
 }
 
 extension MemoDetailViewController:UITextViewDelegate{
     func textViewDidChange(_ textView: UITextView) {
         let updateText = textView.text ?? ""
-        saveData(with:updateText)
+        scheduleSave(with:updateText)
     }
 }